@@ -7,17 +7,38 @@
  * 
  * O jogador pode escolher diferentes algoritmos de ordenação e avaliar
  * seu desempenho através de contadores de comparações e tempo de execução.
+ *
+ * Cada partida/esquadrão possui seu próprio inventário (shard), com
+ * armazenamento, índices e estatísticas independentes. Consultas entre
+ * inventários são distribuídas em um pool de threads.
+ *
+ * Compilação: gcc -O2 -pthread FreeFire.c -o freefire
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
 
 // Definição de constantes
 #define MAX_COMPONENTES 20
 #define TAM_NOME 30
 #define TAM_TIPO 20
+#define MAX_INVENTARIOS 32
+#define TAM_ROTULO 30
+#define MAX_THREADS 16
+
+// Máscaras dos tipos essenciais (índice de tipos de cada inventário)
+#define TIPO_CONTROLE    0x1
+#define TIPO_SUPORTE     0x2
+#define TIPO_PROPULSAO   0x4
+#define TIPO_ENERGIA     0x8
+#define TIPOS_ESSENCIAIS (TIPO_CONTROLE | TIPO_SUPORTE | TIPO_PROPULSAO | TIPO_ENERGIA)
 
 /*
  * STRUCT COMPONENTE
@@ -32,10 +53,53 @@ typedef struct {
     int prioridade;
 } Componente;
 
+/*
+ * STRUCT INVENTARIO
+ * Inventário (shard) de uma partida ou esquadrão
+ * - rotulo: identificação da partida/esquadrão
+ * - componentes / totalComponentes: armazenamento do inventário
+ * - indiceNome: posições dos componentes em ordem alfabética de nome,
+ *   permitindo busca binária sem exigir que o vetor esteja ordenado
+ * - tiposPresentes: máscara de bits dos tipos essenciais presentes
+ * - comparacoes: estatística da última operação neste inventário
+ */
+typedef struct {
+    char rotulo[TAM_ROTULO];
+    Componente componentes[MAX_COMPONENTES];
+    int totalComponentes;
+    int indiceNome[MAX_COMPONENTES];
+    int tiposPresentes;
+    long long comparacoes;
+} Inventario;
+
+/*
+ * STRUCT POOLTHREADS
+ * Pool fixo de threads que executa uma tarefa para cada inventário.
+ * Os trabalhadores disputam os índices de inventário por um contador
+ * atômico; a thread principal também participa do lote.
+ */
+typedef void (*TarefaInventario)(int indiceInventario, void *contexto);
+
+typedef struct {
+    pthread_t threads[MAX_THREADS];
+    int totalThreads;
+    pthread_mutex_t trava;
+    pthread_cond_t temTrabalho;
+    pthread_cond_t trabalhoConcluido;
+    TarefaInventario tarefa;
+    void *contexto;
+    int totalTarefas;
+    atomic_int proximaTarefa;
+    int trabalhadoresAtivos;
+    unsigned long geracao;
+    int encerrar;
+} PoolThreads;
+
 // Variáveis globais
-Componente componentes[MAX_COMPONENTES];
-int totalComponentes = 0;
-long long comparacoes = 0;
+Inventario inventarios[MAX_INVENTARIOS];
+int totalInventarios = 0;
+int inventarioAtivo = 0;
+PoolThreads pool;
 
 /*
  * ============================================================
@@ -91,6 +155,77 @@ void mostrarComponentes(Componente comp[], int total) {
     printf("\n");
 }
 
+/*
+ * FUNÇÃO: tempoAtualMicros
+ * Retorna o tempo de parede em microssegundos
+ * Usado nas operações paralelas, onde clock() somaria o tempo de CPU
+ * de todas as threads
+ */
+double tempoAtualMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000.0 + ts.tv_nsec / 1000.0;
+}
+
+/*
+ * ============================================================
+ *              FUNÇÕES DE INVENTÁRIO (SHARDS)
+ * ============================================================
+ */
+
+/*
+ * FUNÇÃO: inicializarInventario
+ * Prepara um inventário vazio com o rótulo informado
+ */
+void inicializarInventario(Inventario *inv, const char *rotulo) {
+    memset(inv, 0, sizeof(*inv));
+    snprintf(inv->rotulo, TAM_ROTULO, "%s", rotulo);
+}
+
+/*
+ * FUNÇÃO: inventarioAtual
+ * Retorna o inventário selecionado no menu
+ */
+Inventario *inventarioAtual() {
+    return &inventarios[inventarioAtivo];
+}
+
+/*
+ * FUNÇÃO: mascaraTipo
+ * Converte o tipo de um componente na máscara de tipo essencial
+ */
+int mascaraTipo(const char *tipo) {
+    int mascara = 0;
+    if (strstr(tipo, "controle")) mascara |= TIPO_CONTROLE;
+    if (strstr(tipo, "suporte")) mascara |= TIPO_SUPORTE;
+    if (strstr(tipo, "propulsao")) mascara |= TIPO_PROPULSAO;
+    if (strstr(tipo, "energia")) mascara |= TIPO_ENERGIA;
+    return mascara;
+}
+
+/*
+ * FUNÇÃO: atualizarIndices
+ * Reconstrói o índice por nome e a máscara de tipos do inventário
+ * Deve ser chamada sempre que o vetor de componentes mudar
+ * (cadastro ou ordenação), pois o índice guarda posições
+ */
+void atualizarIndices(Inventario *inv) {
+    inv->tiposPresentes = 0;
+    
+    for (int i = 0; i < inv->totalComponentes; i++) {
+        inv->tiposPresentes |= mascaraTipo(inv->componentes[i].tipo);
+        
+        // Insertion Sort das posições pelo nome do componente
+        int j = i - 1;
+        while (j >= 0 && strcmp(inv->componentes[inv->indiceNome[j]].nome,
+                                inv->componentes[i].nome) > 0) {
+            inv->indiceNome[j + 1] = inv->indiceNome[j];
+            j--;
+        }
+        inv->indiceNome[j + 1] = i;
+    }
+}
+
 /*
  * ============================================================
  *              FUNÇÕES DE CADASTRO E ENTRADA
@@ -103,37 +238,40 @@ void mostrarComponentes(Componente comp[], int total) {
  * Valida a entrada de dados e garante consistência
  */
 void cadastrarComponente() {
-    if (totalComponentes >= MAX_COMPONENTES) {
+    Inventario *inv = inventarioAtual();
+    
+    if (inv->totalComponentes >= MAX_COMPONENTES) {
         printf("\n[!] Limite maximo de componentes atingido!\n");
         return;
     }
     
+    Componente *novo = &inv->componentes[inv->totalComponentes];
+    
     printf("\n=== CADASTRAR NOVO COMPONENTE ===\n");
     
     // Leitura do nome com fgets para segurança
     printf("Nome do componente: ");
-    fgets(componentes[totalComponentes].nome, TAM_NOME, stdin);
-    removerNovaLinha(componentes[totalComponentes].nome);
+    fgets(novo->nome, TAM_NOME, stdin);
+    removerNovaLinha(novo->nome);
     
     // Leitura do tipo
     printf("Tipo (controle/suporte/propulsao/energia): ");
-    fgets(componentes[totalComponentes].tipo, TAM_TIPO, stdin);
-    removerNovaLinha(componentes[totalComponentes].tipo);
+    fgets(novo->tipo, TAM_TIPO, stdin);
+    removerNovaLinha(novo->tipo);
     
     // Leitura da prioridade com validação
     do {
         printf("Prioridade (1-10): ");
-        scanf("%d", &componentes[totalComponentes].prioridade);
+        scanf("%d", &novo->prioridade);
         limparBuffer();
         
-        if (componentes[totalComponentes].prioridade < 1 || 
-            componentes[totalComponentes].prioridade > 10) {
+        if (novo->prioridade < 1 || novo->prioridade > 10) {
             printf("[!] Prioridade deve estar entre 1 e 10!\n");
         }
-    } while (componentes[totalComponentes].prioridade < 1 || 
-             componentes[totalComponentes].prioridade > 10);
+    } while (novo->prioridade < 1 || novo->prioridade > 10);
     
-    totalComponentes++;
+    inv->totalComponentes++;
+    atualizarIndices(inv);
     printf("\n[OK] Componente cadastrado com sucesso!\n");
 }
 
@@ -142,6 +280,7 @@ void cadastrarComponente() {
  * Permite cadastrar múltiplos componentes de uma vez
  */
 void cadastrarLote() {
+    Inventario *inv = inventarioAtual();
     int quantidade;
     
     printf("\n=== CADASTRO EM LOTE ===\n");
@@ -154,9 +293,9 @@ void cadastrarLote() {
         return;
     }
     
-    if (totalComponentes + quantidade > MAX_COMPONENTES) {
+    if (inv->totalComponentes + quantidade > MAX_COMPONENTES) {
         printf("[!] Isso excederia o limite! Espaco disponivel: %d\n", 
-               MAX_COMPONENTES - totalComponentes);
+               MAX_COMPONENTES - inv->totalComponentes);
         return;
     }
     
@@ -182,12 +321,12 @@ void cadastrarLote() {
  * - Ineficiente para grandes conjuntos
  * - Realiza muitas trocas
  */
-void bubbleSortNome(Componente comp[], int total) {
-    comparacoes = 0;
+void bubbleSortNome(Componente comp[], int total, long long *comparacoes) {
+    *comparacoes = 0;
     
     for (int i = 0; i < total - 1; i++) {
         for (int j = 0; j < total - i - 1; j++) {
-            comparacoes++;
+            (*comparacoes)++;
             if (strcmp(comp[j].nome, comp[j + 1].nome) > 0) {
                 // Troca os componentes
                 Componente temp = comp[j];
@@ -208,8 +347,8 @@ void bubbleSortNome(Componente comp[], int total) {
  * - Adaptável (rápido se já estiver parcialmente ordenado)
  * - Estável (mantém ordem relativa de elementos iguais)
  */
-void insertionSortTipo(Componente comp[], int total) {
-    comparacoes = 0;
+void insertionSortTipo(Componente comp[], int total, long long *comparacoes) {
+    *comparacoes = 0;
     
     for (int i = 1; i < total; i++) {
         Componente chave = comp[i];
@@ -217,7 +356,7 @@ void insertionSortTipo(Componente comp[], int total) {
         
         // Move elementos maiores que a chave uma posição à frente
         while (j >= 0) {
-            comparacoes++;
+            (*comparacoes)++;
             if (strcmp(comp[j].tipo, chave.tipo) > 0) {
                 comp[j + 1] = comp[j];
                 j--;
@@ -239,15 +378,15 @@ void insertionSortTipo(Componente comp[], int total) {
  * - Minimiza o número de trocas
  * - Não é adaptável
  */
-void selectionSortPrioridade(Componente comp[], int total) {
-    comparacoes = 0;
+void selectionSortPrioridade(Componente comp[], int total, long long *comparacoes) {
+    *comparacoes = 0;
     
     for (int i = 0; i < total - 1; i++) {
         int indiceMaior = i;
         
         // Procura o elemento de maior prioridade
         for (int j = i + 1; j < total; j++) {
-            comparacoes++;
+            (*comparacoes)++;
             if (comp[j].prioridade > comp[indiceMaior].prioridade) {
                 indiceMaior = j;
             }
@@ -276,13 +415,13 @@ void selectionSortPrioridade(Componente comp[], int total) {
  * Pré-requisito: O array DEVE estar ordenado por nome
  * Retorna: índice do componente ou -1 se não encontrado
  */
-int buscaBinariaPorNome(Componente comp[], int total, char nomeBusca[]) {
+int buscaBinariaPorNome(Componente comp[], int total, char nomeBusca[], long long *comparacoes) {
     int esquerda = 0;
     int direita = total - 1;
-    comparacoes = 0;
+    *comparacoes = 0;
     
     while (esquerda <= direita) {
-        comparacoes++;
+        (*comparacoes)++;
         int meio = esquerda + (direita - esquerda) / 2;
         int resultado = strcmp(comp[meio].nome, nomeBusca);
         
@@ -298,6 +437,38 @@ int buscaBinariaPorNome(Componente comp[], int total, char nomeBusca[]) {
     return -1;
 }
 
+/*
+ * FUNÇÃO: buscaBinariaIndexada
+ * Realiza busca binária pelo índice por nome do inventário
+ * Complexidade: O(log n)
+ * 
+ * Não exige que o vetor esteja ordenado: o índice guarda as posições
+ * em ordem alfabética. Só lê o inventário, podendo rodar em paralelo.
+ * Retorna: posição do componente no vetor ou -1 se não encontrado
+ */
+int buscaBinariaIndexada(const Inventario *inv, const char nomeBusca[], long long *comparacoes) {
+    int esquerda = 0;
+    int direita = inv->totalComponentes - 1;
+    *comparacoes = 0;
+    
+    while (esquerda <= direita) {
+        (*comparacoes)++;
+        int meio = esquerda + (direita - esquerda) / 2;
+        int posicao = inv->indiceNome[meio];
+        int resultado = strcmp(inv->componentes[posicao].nome, nomeBusca);
+        
+        if (resultado == 0) {
+            return posicao;
+        } else if (resultado < 0) {
+            esquerda = meio + 1;
+        } else {
+            direita = meio - 1;
+        }
+    }
+    
+    return -1;
+}
+
 /*
  * ============================================================
  *              FUNÇÕES DE MEDIÇÃO E ANÁLISE
@@ -309,9 +480,11 @@ int buscaBinariaPorNome(Componente comp[], int total, char nomeBusca[]) {
  * Executa um algoritmo de ordenação e mede seu desempenho
  * Exibe estatísticas completas sobre a execução
  */
-void executarOrdenacaoComMedicao(void (*algoritmo)(Componente[], int), 
+void executarOrdenacaoComMedicao(void (*algoritmo)(Componente[], int, long long*), 
                                   const char* nomeAlgoritmo) {
-    if (totalComponentes == 0) {
+    Inventario *inv = inventarioAtual();
+    
+    if (inv->totalComponentes == 0) {
         printf("\n[!] Nenhum componente cadastrado!\n");
         return;
     }
@@ -321,20 +494,23 @@ void executarOrdenacaoComMedicao(void (*algoritmo)(Componente[], int),
     
     // Mede o tempo de execução
     clock_t inicio = clock();
-    algoritmo(componentes, totalComponentes);
+    algoritmo(inv->componentes, inv->totalComponentes, &inv->comparacoes);
     clock_t fim = clock();
     
+    // As posições mudaram: o índice por nome precisa ser refeito
+    atualizarIndices(inv);
+    
     double tempoGasto = ((double)(fim - inicio)) / CLOCKS_PER_SEC * 1000000;
     
     // Exibe estatísticas
     printf("\n--- ESTATISTICAS DE DESEMPENHO ---\n");
     printf("Algoritmo:           %s\n", nomeAlgoritmo);
-    printf("Componentes:         %d\n", totalComponentes);
-    printf("Comparacoes:         %lld\n", comparacoes);
+    printf("Componentes:         %d\n", inv->totalComponentes);
+    printf("Comparacoes:         %lld\n", inv->comparacoes);
     printf("Tempo de execucao:   %.2f microsegundos\n", tempoGasto);
     
     // Exibe os componentes ordenados
-    mostrarComponentes(componentes, totalComponentes);
+    mostrarComponentes(inv->componentes, inv->totalComponentes);
     
     printf("[OK] Ordenacao concluida com sucesso!\n");
 }
@@ -345,7 +521,9 @@ void executarOrdenacaoComMedicao(void (*algoritmo)(Componente[], int),
  * Utiliza busca binária para eficiência máxima
  */
 void buscarComponenteChave() {
-    if (totalComponentes == 0) {
+    Inventario *inv = inventarioAtual();
+    
+    if (inv->totalComponentes == 0) {
         printf("\n[!] Nenhum componente cadastrado!\n");
         return;
     }
@@ -361,7 +539,8 @@ void buscarComponenteChave() {
     printf("\nIniciando busca binaria...\n");
     
     clock_t inicio = clock();
-    int indice = buscaBinariaPorNome(componentes, totalComponentes, nomeBusca);
+    int indice = buscaBinariaPorNome(inv->componentes, inv->totalComponentes, 
+                                     nomeBusca, &inv->comparacoes);
     clock_t fim = clock();
     
     double tempoGasto = ((double)(fim - inicio)) / CLOCKS_PER_SEC * 1000000;
@@ -370,9 +549,9 @@ void buscarComponenteChave() {
         printf("\n========================================\n");
         printf("    COMPONENTE-CHAVE ENCONTRADO!\n");
         printf("========================================\n");
-        printf("Nome:       %s\n", componentes[indice].nome);
-        printf("Tipo:       %s\n", componentes[indice].tipo);
-        printf("Prioridade: %d\n", componentes[indice].prioridade);
+        printf("Nome:       %s\n", inv->componentes[indice].nome);
+        printf("Tipo:       %s\n", inv->componentes[indice].tipo);
+        printf("Prioridade: %d\n", inv->componentes[indice].prioridade);
         printf("Posicao:    [%d]\n", indice + 1);
         printf("\n[OK] Torre de fuga pode ser ativada!\n");
     } else {
@@ -381,7 +560,7 @@ void buscarComponenteChave() {
     }
     
     printf("\n--- ESTATISTICAS DA BUSCA BINARIA ---\n");
-    printf("Comparacoes realizadas: %lld\n", comparacoes);
+    printf("Comparacoes realizadas: %lld\n", inv->comparacoes);
     printf("Tempo de execucao:      %.2f microsegundos\n", tempoGasto);
 }
 
@@ -391,7 +570,10 @@ void buscarComponenteChave() {
  * Útil para decisões estratégicas baseadas em dados
  */
 void compararAlgoritmos() {
-    if (totalComponentes == 0) {
+    Inventario *inv = inventarioAtual();
+    int total = inv->totalComponentes;
+    
+    if (total == 0) {
         printf("\n[!] Nenhum componente cadastrado!\n");
         return;
     }
@@ -405,35 +587,34 @@ void compararAlgoritmos() {
     Componente copia2[MAX_COMPONENTES];
     Componente copia3[MAX_COMPONENTES];
     
-    for (int i = 0; i < totalComponentes; i++) {
-        copia1[i] = componentes[i];
-        copia2[i] = componentes[i];
-        copia3[i] = componentes[i];
+    for (int i = 0; i < total; i++) {
+        copia1[i] = inv->componentes[i];
+        copia2[i] = inv->componentes[i];
+        copia3[i] = inv->componentes[i];
     }
     
+    long long compBubble, compInsertion, compSelection;
+    
     // Teste 1: Bubble Sort
     clock_t inicio = clock();
-    bubbleSortNome(copia1, totalComponentes);
+    bubbleSortNome(copia1, total, &compBubble);
     clock_t fim = clock();
     double tempoBubble = ((double)(fim - inicio)) / CLOCKS_PER_SEC * 1000000;
-    long long compBubble = comparacoes;
     
     // Teste 2: Insertion Sort
     inicio = clock();
-    insertionSortTipo(copia2, totalComponentes);
+    insertionSortTipo(copia2, total, &compInsertion);
     fim = clock();
     double tempoInsertion = ((double)(fim - inicio)) / CLOCKS_PER_SEC * 1000000;
-    long long compInsertion = comparacoes;
     
     // Teste 3: Selection Sort
     inicio = clock();
-    selectionSortPrioridade(copia3, totalComponentes);
+    selectionSortPrioridade(copia3, total, &compSelection);
     fim = clock();
     double tempoSelection = ((double)(fim - inicio)) / CLOCKS_PER_SEC * 1000000;
-    long long compSelection = comparacoes;
     
     // Exibe resultados comparativos
-    printf("\nNumero de componentes: %d\n\n", totalComponentes);
+    printf("\nNumero de componentes: %d\n\n", total);
     printf("%-20s %-15s %-20s\n", "ALGORITMO", "COMPARACOES", "TEMPO (us)");
     printf("------------------------------------------------------------------------\n");
     printf("%-20s %-15lld %-20.2f\n", "Bubble Sort", compBubble, tempoBubble);
@@ -467,29 +648,25 @@ void compararAlgoritmos() {
 /*
  * FUNÇÃO: verificarComponentesEssenciais
  * Verifica se todos os tipos essenciais de componentes estão presentes
+ * Consulta a máscara de tipos mantida pelo índice do inventário
  */
 void verificarComponentesEssenciais() {
-    if (totalComponentes == 0) {
+    Inventario *inv = inventarioAtual();
+    
+    if (inv->totalComponentes == 0) {
         printf("\n[!] Nenhum componente cadastrado!\n");
         return;
     }
     
-    int temControle = 0, temSuporte = 0, temPropulsao = 0, temEnergia = 0;
-    
-    for (int i = 0; i < totalComponentes; i++) {
-        if (strstr(componentes[i].tipo, "controle")) temControle = 1;
-        if (strstr(componentes[i].tipo, "suporte")) temSuporte = 1;
-        if (strstr(componentes[i].tipo, "propulsao")) temPropulsao = 1;
-        if (strstr(componentes[i].tipo, "energia")) temEnergia = 1;
-    }
+    int tipos = inv->tiposPresentes;
     
     printf("\n=== VERIFICACAO DE COMPONENTES ESSENCIAIS ===\n");
-    printf("Controle:   %s\n", temControle ? "[OK]" : "[FALTANDO]");
-    printf("Suporte:    %s\n", temSuporte ? "[OK]" : "[FALTANDO]");
-    printf("Propulsao:  %s\n", temPropulsao ? "[OK]" : "[FALTANDO]");
-    printf("Energia:    %s\n", temEnergia ? "[OK]" : "[FALTANDO]");
+    printf("Controle:   %s\n", (tipos & TIPO_CONTROLE) ? "[OK]" : "[FALTANDO]");
+    printf("Suporte:    %s\n", (tipos & TIPO_SUPORTE) ? "[OK]" : "[FALTANDO]");
+    printf("Propulsao:  %s\n", (tipos & TIPO_PROPULSAO) ? "[OK]" : "[FALTANDO]");
+    printf("Energia:    %s\n", (tipos & TIPO_ENERGIA) ? "[OK]" : "[FALTANDO]");
     
-    if (temControle && temSuporte && temPropulsao && temEnergia) {
+    if (tipos == TIPOS_ESSENCIAIS) {
         printf("\n[OK] Todos os componentes essenciais estao presentes!\n");
         printf("A torre pode ser montada.\n");
     } else {
@@ -503,7 +680,9 @@ void verificarComponentesEssenciais() {
  * Simula a montagem da torre seguindo a ordem de prioridade
  */
 void simularMontagem() {
-    if (totalComponentes == 0) {
+    Inventario *inv = inventarioAtual();
+    
+    if (inv->totalComponentes == 0) {
         printf("\n[!] Nenhum componente cadastrado!\n");
         return;
     }
@@ -514,22 +693,503 @@ void simularMontagem() {
     
     // Ordena por prioridade
     printf("\nOrdenando componentes por prioridade...\n");
-    selectionSortPrioridade(componentes, totalComponentes);
+    selectionSortPrioridade(inv->componentes, inv->totalComponentes, &inv->comparacoes);
+    atualizarIndices(inv);
     
     printf("\n--- SEQUENCIA DE MONTAGEM ---\n");
     printf("Os componentes devem ser instalados na seguinte ordem:\n\n");
     
-    for (int i = 0; i < totalComponentes; i++) {
+    for (int i = 0; i < inv->totalComponentes; i++) {
         printf("Passo %d: [Prioridade %d] %s (%s)\n", 
                i + 1, 
-               componentes[i].prioridade,
-               componentes[i].nome,
-               componentes[i].tipo);
+               inv->componentes[i].prioridade,
+               inv->componentes[i].nome,
+               inv->componentes[i].tipo);
     }
     
     printf("\n[OK] Sequencia de montagem estabelecida!\n");
 }
 
+/*
+ * ============================================================
+ *           POOL DE THREADS E CONSULTAS ENTRE INVENTÁRIOS
+ * ============================================================
+ */
+
+/*
+ * FUNÇÃO: executarTarefasDisponiveis
+ * Retira índices de inventário do contador atômico do lote atual
+ * e executa a tarefa até que não reste nenhum
+ */
+void executarTarefasDisponiveis(TarefaInventario tarefa, void *contexto, int totalTarefas) {
+    int indice;
+    while ((indice = atomic_fetch_add(&pool.proximaTarefa, 1)) < totalTarefas) {
+        tarefa(indice, contexto);
+    }
+}
+
+/*
+ * FUNÇÃO: trabalhadorPool
+ * Laço de cada thread do pool: aguarda um novo lote (geração),
+ * copia seus parâmetros sob a trava e participa da execução
+ */
+void *trabalhadorPool(void *arg) {
+    (void)arg;
+    unsigned long geracaoVista = 0;
+    
+    pthread_mutex_lock(&pool.trava);
+    while (1) {
+        while (!pool.encerrar && pool.geracao == geracaoVista) {
+            pthread_cond_wait(&pool.temTrabalho, &pool.trava);
+        }
+        if (pool.encerrar) {
+            break;
+        }
+        
+        geracaoVista = pool.geracao;
+        TarefaInventario tarefa = pool.tarefa;
+        void *contexto = pool.contexto;
+        int totalTarefas = pool.totalTarefas;
+        pool.trabalhadoresAtivos++;
+        pthread_mutex_unlock(&pool.trava);
+        
+        executarTarefasDisponiveis(tarefa, contexto, totalTarefas);
+        
+        pthread_mutex_lock(&pool.trava);
+        pool.trabalhadoresAtivos--;
+        if (pool.trabalhadoresAtivos == 0) {
+            pthread_cond_broadcast(&pool.trabalhoConcluido);
+        }
+    }
+    pthread_mutex_unlock(&pool.trava);
+    
+    return NULL;
+}
+
+/*
+ * FUNÇÃO: iniciarPool
+ * Cria uma thread por núcleo disponível (a thread principal conta
+ * como uma delas). Se a criação falhar, segue com as já criadas.
+ */
+void iniciarPool() {
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    int desejadas = (nucleos > 1) ? (int)(nucleos - 1) : 0;
+    if (desejadas > MAX_THREADS) {
+        desejadas = MAX_THREADS;
+    }
+    
+    pthread_mutex_init(&pool.trava, NULL);
+    pthread_cond_init(&pool.temTrabalho, NULL);
+    pthread_cond_init(&pool.trabalhoConcluido, NULL);
+    atomic_init(&pool.proximaTarefa, 0);
+    pool.totalThreads = 0;
+    pool.trabalhadoresAtivos = 0;
+    pool.geracao = 0;
+    pool.encerrar = 0;
+    
+    for (int i = 0; i < desejadas; i++) {
+        if (pthread_create(&pool.threads[i], NULL, trabalhadorPool, NULL) != 0) {
+            break;
+        }
+        pool.totalThreads++;
+    }
+}
+
+/*
+ * FUNÇÃO: encerrarPool
+ * Sinaliza o fim aos trabalhadores e aguarda todos terminarem
+ */
+void encerrarPool() {
+    pthread_mutex_lock(&pool.trava);
+    pool.encerrar = 1;
+    pthread_cond_broadcast(&pool.temTrabalho);
+    pthread_mutex_unlock(&pool.trava);
+    
+    for (int i = 0; i < pool.totalThreads; i++) {
+        pthread_join(pool.threads[i], NULL);
+    }
+    
+    pthread_cond_destroy(&pool.trabalhoConcluido);
+    pthread_cond_destroy(&pool.temTrabalho);
+    pthread_mutex_destroy(&pool.trava);
+}
+
+/*
+ * FUNÇÃO: executarEmTodosInventarios
+ * Executa a tarefa uma vez para cada inventário, em paralelo
+ * Retorna somente quando todos os inventários foram processados
+ * 
+ * Cada tarefa deve escrever apenas na sua posição do contexto e
+ * no próprio inventário, dispensando travas entre as threads
+ */
+void executarEmTodosInventarios(TarefaInventario tarefa, void *contexto) {
+    pthread_mutex_lock(&pool.trava);
+    // Trabalhadores atrasados do lote anterior precisam sair antes
+    while (pool.trabalhadoresAtivos > 0) {
+        pthread_cond_wait(&pool.trabalhoConcluido, &pool.trava);
+    }
+    pool.tarefa = tarefa;
+    pool.contexto = contexto;
+    pool.totalTarefas = totalInventarios;
+    atomic_store(&pool.proximaTarefa, 0);
+    pool.geracao++;
+    pthread_cond_broadcast(&pool.temTrabalho);
+    pthread_mutex_unlock(&pool.trava);
+    
+    // A thread principal também processa inventários
+    executarTarefasDisponiveis(tarefa, contexto, totalInventarios);
+    
+    pthread_mutex_lock(&pool.trava);
+    while (pool.trabalhadoresAtivos > 0) {
+        pthread_cond_wait(&pool.trabalhoConcluido, &pool.trava);
+    }
+    pthread_mutex_unlock(&pool.trava);
+}
+
+/*
+ * Busca do componente-chave em todos os inventários
+ * - posicoes: resultado por inventário (-1 se ausente)
+ */
+typedef struct {
+    char nome[TAM_NOME];
+    int posicoes[MAX_INVENTARIOS];
+} ContextoBusca;
+
+void tarefaBuscarChave(int indiceInventario, void *contexto) {
+    ContextoBusca *ctx = contexto;
+    Inventario *inv = &inventarios[indiceInventario];
+    
+    ctx->posicoes[indiceInventario] = buscaBinariaIndexada(inv, ctx->nome, &inv->comparacoes);
+}
+
+/*
+ * FUNÇÃO: buscarChaveEmTodosInventarios
+ * Procura o componente-chave em todos os inventários ao mesmo tempo
+ */
+void buscarChaveEmTodosInventarios() {
+    ContextoBusca ctx;
+    
+    printf("\n=== BUSCAR COMPONENTE-CHAVE EM TODOS OS INVENTARIOS ===\n");
+    printf("Digite o nome do componente-chave: ");
+    fgets(ctx.nome, TAM_NOME, stdin);
+    removerNovaLinha(ctx.nome);
+    
+    double inicio = tempoAtualMicros();
+    executarEmTodosInventarios(tarefaBuscarChave, &ctx);
+    double tempoGasto = tempoAtualMicros() - inicio;
+    
+    int encontrados = 0;
+    long long totalComparacoes = 0;
+    
+    printf("\n%-4s %-28s %-12s %-12s\n", "ID", "INVENTARIO", "POSICAO", "COMPARACOES");
+    printf("------------------------------------------------------------------------\n");
+    for (int i = 0; i < totalInventarios; i++) {
+        totalComparacoes += inventarios[i].comparacoes;
+        if (ctx.posicoes[i] != -1) {
+            encontrados++;
+            printf("%-4d %-28s %-12d %-12lld\n", i + 1, inventarios[i].rotulo,
+                   ctx.posicoes[i] + 1, inventarios[i].comparacoes);
+        } else {
+            printf("%-4d %-28s %-12s %-12lld\n", i + 1, inventarios[i].rotulo,
+                   "AUSENTE", inventarios[i].comparacoes);
+        }
+    }
+    
+    printf("\n--- ESTATISTICAS DA BUSCA PARALELA ---\n");
+    printf("Encontrado em:          %d de %d inventarios\n", encontrados, totalInventarios);
+    printf("Comparacoes realizadas: %lld\n", totalComparacoes);
+    printf("Threads utilizadas:     %d\n", pool.totalThreads + 1);
+    printf("Tempo de execucao:      %.2f microsegundos\n", tempoGasto);
+}
+
+/*
+ * Top-K global por prioridade
+ * - melhores: top-k local de cada inventário, em ordem decrescente
+ * - totais: quantos itens cada inventário contribuiu
+ */
+typedef struct {
+    int k;
+    Componente melhores[MAX_INVENTARIOS][MAX_COMPONENTES];
+    int totais[MAX_INVENTARIOS];
+} ContextoTopK;
+
+/*
+ * Cada inventário ordena apenas os k primeiros de uma cópia
+ * (Selection Sort parcial, O(n·k)); o inventário não é alterado
+ */
+void tarefaTopKLocal(int indiceInventario, void *contexto) {
+    ContextoTopK *ctx = contexto;
+    Inventario *inv = &inventarios[indiceInventario];
+    Componente *comp = ctx->melhores[indiceInventario];
+    int total = inv->totalComponentes;
+    int limite = (ctx->k < total) ? ctx->k : total;
+    
+    memcpy(comp, inv->componentes, total * sizeof(Componente));
+    inv->comparacoes = 0;
+    
+    for (int i = 0; i < limite; i++) {
+        int indiceMaior = i;
+        for (int j = i + 1; j < total; j++) {
+            inv->comparacoes++;
+            if (comp[j].prioridade > comp[indiceMaior].prioridade) {
+                indiceMaior = j;
+            }
+        }
+        if (indiceMaior != i) {
+            Componente temp = comp[i];
+            comp[i] = comp[indiceMaior];
+            comp[indiceMaior] = temp;
+        }
+    }
+    
+    ctx->totais[indiceInventario] = limite;
+}
+
+/*
+ * STRUCT ENTRADAHEAP
+ * Cabeça de uma lista local no heap de intercalação (k-way merge)
+ */
+typedef struct {
+    int prioridade;
+    int inventario;
+    int posicao;
+} EntradaHeap;
+
+/*
+ * FUNÇÃO: entradaMaior
+ * Maior prioridade primeiro; em empate, o inventário de menor ID
+ */
+int entradaMaior(const EntradaHeap *a, const EntradaHeap *b) {
+    if (a->prioridade != b->prioridade) {
+        return a->prioridade > b->prioridade;
+    }
+    return a->inventario < b->inventario;
+}
+
+/*
+ * FUNÇÃO: descerHeap
+ * Restaura a propriedade de max-heap a partir da posição indicada
+ */
+void descerHeap(EntradaHeap heap[], int tamanho, int posicao) {
+    while (1) {
+        int maior = posicao;
+        int esquerda = 2 * posicao + 1;
+        int direita = 2 * posicao + 2;
+        
+        if (esquerda < tamanho && entradaMaior(&heap[esquerda], &heap[maior])) maior = esquerda;
+        if (direita < tamanho && entradaMaior(&heap[direita], &heap[maior])) maior = direita;
+        if (maior == posicao) {
+            return;
+        }
+        
+        EntradaHeap temp = heap[posicao];
+        heap[posicao] = heap[maior];
+        heap[maior] = temp;
+        posicao = maior;
+    }
+}
+
+/*
+ * FUNÇÃO: topKGlobalPorPrioridade
+ * Calcula o top-k local de cada inventário em paralelo e intercala
+ * os resultados com um max-heap de tamanho igual ao de inventários
+ * Complexidade da intercalação: O(k log S), S = total de inventários
+ */
+void topKGlobalPorPrioridade() {
+    int totalGeral = 0;
+    for (int i = 0; i < totalInventarios; i++) {
+        totalGeral += inventarios[i].totalComponentes;
+    }
+    
+    if (totalGeral == 0) {
+        printf("\n[!] Nenhum componente cadastrado!\n");
+        return;
+    }
+    
+    ContextoTopK ctx;
+    
+    printf("\n=== TOP-K GLOBAL POR PRIORIDADE ===\n");
+    do {
+        printf("Quantos componentes (1-%d)? ", totalGeral);
+        scanf("%d", &ctx.k);
+        limparBuffer();
+        
+        if (ctx.k < 1 || ctx.k > totalGeral) {
+            printf("[!] Valor deve estar entre 1 e %d!\n", totalGeral);
+        }
+    } while (ctx.k < 1 || ctx.k > totalGeral);
+    
+    double inicio = tempoAtualMicros();
+    executarEmTodosInventarios(tarefaTopKLocal, &ctx);
+    
+    // Intercalação k-way: o heap guarda a cabeça de cada lista local
+    EntradaHeap heap[MAX_INVENTARIOS];
+    int tamanho = 0;
+    for (int i = 0; i < totalInventarios; i++) {
+        if (ctx.totais[i] > 0) {
+            heap[tamanho].prioridade = ctx.melhores[i][0].prioridade;
+            heap[tamanho].inventario = i;
+            heap[tamanho].posicao = 0;
+            tamanho++;
+        }
+    }
+    for (int i = tamanho / 2 - 1; i >= 0; i--) {
+        descerHeap(heap, tamanho, i);
+    }
+    
+    EntradaHeap resultado[MAX_INVENTARIOS * MAX_COMPONENTES];
+    int obtidos = 0;
+    while (obtidos < ctx.k && tamanho > 0) {
+        resultado[obtidos++] = heap[0];
+        
+        int inv = heap[0].inventario;
+        int proxima = heap[0].posicao + 1;
+        if (proxima < ctx.totais[inv]) {
+            heap[0].prioridade = ctx.melhores[inv][proxima].prioridade;
+            heap[0].posicao = proxima;
+        } else {
+            heap[0] = heap[--tamanho];
+        }
+        descerHeap(heap, tamanho, 0);
+    }
+    double tempoGasto = tempoAtualMicros() - inicio;
+    
+    printf("\n%-6s %-20s %-24s %-12s %-10s\n", "RANK", "INVENTARIO", "NOME", "TIPO", "PRIORIDADE");
+    printf("------------------------------------------------------------------------\n");
+    for (int i = 0; i < obtidos; i++) {
+        Componente *c = &ctx.melhores[resultado[i].inventario][resultado[i].posicao];
+        printf("%-6d %-20.20s %-24.24s %-12.12s %-10d\n", i + 1,
+               inventarios[resultado[i].inventario].rotulo, c->nome, c->tipo, c->prioridade);
+    }
+    
+    long long totalComparacoes = 0;
+    for (int i = 0; i < totalInventarios; i++) {
+        totalComparacoes += inventarios[i].comparacoes;
+    }
+    
+    printf("\n--- ESTATISTICAS DO TOP-K PARALELO ---\n");
+    printf("Inventarios:            %d\n", totalInventarios);
+    printf("Comparacoes (locais):   %lld\n", totalComparacoes);
+    printf("Threads utilizadas:     %d\n", pool.totalThreads + 1);
+    printf("Tempo de execucao:      %.2f microsegundos\n", tempoGasto);
+}
+
+/*
+ * Verificação de essenciais em cada inventário
+ * - tipos: máscara de tipos essenciais de cada inventário
+ */
+typedef struct {
+    int tipos[MAX_INVENTARIOS];
+} ContextoEssenciais;
+
+void tarefaVerificarEssenciais(int indiceInventario, void *contexto) {
+    ContextoEssenciais *ctx = contexto;
+    ctx->tipos[indiceInventario] = inventarios[indiceInventario].tiposPresentes;
+}
+
+/*
+ * FUNÇÃO: verificarEssenciaisEmTodosInventarios
+ * Informa, para cada inventário, quais tipos essenciais estão presentes
+ */
+void verificarEssenciaisEmTodosInventarios() {
+    ContextoEssenciais ctx;
+    
+    double inicio = tempoAtualMicros();
+    executarEmTodosInventarios(tarefaVerificarEssenciais, &ctx);
+    double tempoGasto = tempoAtualMicros() - inicio;
+    
+    int prontos = 0;
+    
+    printf("\n=== VERIFICACAO DE ESSENCIAIS POR INVENTARIO ===\n");
+    printf("\n%-4s %-24s %-5s %-5s %-5s %-5s %-10s\n",
+           "ID", "INVENTARIO", "CTRL", "SUP", "PROP", "ENER", "SITUACAO");
+    printf("------------------------------------------------------------------------\n");
+    for (int i = 0; i < totalInventarios; i++) {
+        int tipos = ctx.tipos[i];
+        if (tipos == TIPOS_ESSENCIAIS) {
+            prontos++;
+        }
+        printf("%-4d %-24.24s %-5s %-5s %-5s %-5s %-10s\n", i + 1, inventarios[i].rotulo,
+               (tipos & TIPO_CONTROLE) ? "OK" : "--",
+               (tipos & TIPO_SUPORTE) ? "OK" : "--",
+               (tipos & TIPO_PROPULSAO) ? "OK" : "--",
+               (tipos & TIPO_ENERGIA) ? "OK" : "--",
+               (tipos == TIPOS_ESSENCIAIS) ? "PRONTO" : "INCOMPLETO");
+    }
+    
+    printf("\nTorres prontas para montagem: %d de %d\n", prontos, totalInventarios);
+    printf("Tempo de execucao:            %.2f microsegundos\n", tempoGasto);
+}
+
+/*
+ * ============================================================
+ *              GERENCIAMENTO DE INVENTÁRIOS
+ * ============================================================
+ */
+
+/*
+ * FUNÇÃO: criarInventario
+ * Cria um novo inventário vazio para outra partida/esquadrão
+ */
+void criarInventario() {
+    if (totalInventarios >= MAX_INVENTARIOS) {
+        printf("\n[!] Limite maximo de inventarios atingido!\n");
+        return;
+    }
+    
+    char rotulo[TAM_ROTULO];
+    
+    printf("\n=== CRIAR NOVO INVENTARIO ===\n");
+    printf("Nome da partida/esquadrao: ");
+    fgets(rotulo, TAM_ROTULO, stdin);
+    removerNovaLinha(rotulo);
+    
+    if (rotulo[0] == '\0') {
+        snprintf(rotulo, TAM_ROTULO, "Partida %d", totalInventarios + 1);
+    }
+    
+    inicializarInventario(&inventarios[totalInventarios], rotulo);
+    inventarioAtivo = totalInventarios;
+    totalInventarios++;
+    
+    printf("\n[OK] Inventario '%s' criado e selecionado!\n", rotulo);
+}
+
+/*
+ * FUNÇÃO: listarInventarios
+ * Exibe todos os inventários e indica o ativo
+ */
+void listarInventarios() {
+    printf("\n%-4s %-28s %-14s\n", "ID", "INVENTARIO", "COMPONENTES");
+    printf("------------------------------------------------------------------------\n");
+    for (int i = 0; i < totalInventarios; i++) {
+        printf("%-4d %-28s %2d/%-11d%s\n", i + 1, inventarios[i].rotulo,
+               inventarios[i].totalComponentes, MAX_COMPONENTES,
+               (i == inventarioAtivo) ? "<- ativo" : "");
+    }
+}
+
+/*
+ * FUNÇÃO: selecionarInventario
+ * Troca o inventário usado pelas demais opções do menu
+ */
+void selecionarInventario() {
+    int id;
+    
+    listarInventarios();
+    printf("\nID do inventario: ");
+    scanf("%d", &id);
+    limparBuffer();
+    
+    if (id < 1 || id > totalInventarios) {
+        printf("[!] Inventario invalido!\n");
+        return;
+    }
+    
+    inventarioAtivo = id - 1;
+    printf("\n[OK] Inventario '%s' selecionado!\n", inventarioAtual()->rotulo);
+}
+
 /*
  * ============================================================
  *                    MENUS E INTERFACE
@@ -578,6 +1238,82 @@ void menuOrdenacao() {
     } while(opcao != 0);
 }
 
+/*
+ * FUNÇÃO: menuInventarios
+ * Submenu para criar e selecionar inventários (um por partida/esquadrão)
+ */
+void menuInventarios() {
+    int opcao;
+    
+    do {
+        printf("\n========================================\n");
+        printf("       MENU DE INVENTARIOS\n");
+        printf("========================================\n");
+        printf("[1] Criar novo inventario\n");
+        printf("[2] Selecionar inventario ativo\n");
+        printf("[3] Listar inventarios\n");
+        printf("[0] Voltar\n");
+        printf("\nEscolha: ");
+        scanf("%d", &opcao);
+        limparBuffer();
+        
+        switch(opcao) {
+            case 1:
+                criarInventario();
+                break;
+            case 2:
+                selecionarInventario();
+                break;
+            case 3:
+                listarInventarios();
+                break;
+            case 0:
+                printf("\nVoltando ao menu principal...\n");
+                break;
+            default:
+                printf("\n[!] Opcao invalida!\n");
+        }
+    } while(opcao != 0);
+}
+
+/*
+ * FUNÇÃO: menuOperacoesParalelas
+ * Submenu das consultas executadas em todos os inventários
+ */
+void menuOperacoesParalelas() {
+    int opcao;
+    
+    do {
+        printf("\n========================================\n");
+        printf("       CONSULTAS ENTRE INVENTARIOS\n");
+        printf("========================================\n");
+        printf("[1] Buscar componente-chave em todos\n");
+        printf("[2] Top-K global por prioridade\n");
+        printf("[3] Verificar essenciais de cada inventario\n");
+        printf("[0] Voltar\n");
+        printf("\nEscolha: ");
+        scanf("%d", &opcao);
+        limparBuffer();
+        
+        switch(opcao) {
+            case 1:
+                buscarChaveEmTodosInventarios();
+                break;
+            case 2:
+                topKGlobalPorPrioridade();
+                break;
+            case 3:
+                verificarEssenciaisEmTodosInventarios();
+                break;
+            case 0:
+                printf("\nVoltando ao menu principal...\n");
+                break;
+            default:
+                printf("\n[!] Opcao invalida!\n");
+        }
+    } while(opcao != 0);
+}
+
 /*
  * FUNÇÃO: menuPrincipal
  * Menu principal do sistema
@@ -589,6 +1325,8 @@ void menuPrincipal() {
         printf("\n========================================================================\n");
         printf("           SISTEMA DE MONTAGEM DA TORRE DE FUGA - NIVEL MESTRE\n");
         printf("========================================================================\n");
+        printf("Inventario ativo: %s (%d/%d)\n\n", inventarioAtual()->rotulo,
+               inventarioAtivo + 1, totalInventarios);
         printf("[1]  Cadastrar componente\n");
         printf("[2]  Cadastrar lote de componentes\n");
         printf("[3]  Listar componentes\n");
@@ -596,6 +1334,8 @@ void menuPrincipal() {
         printf("[5]  Buscar componente-chave (busca binaria)\n");
         printf("[6]  Verificar componentes essenciais\n");
         printf("[7]  Simular montagem da torre\n");
+        printf("[8]  Gerenciar inventarios (partidas/esquadroes)\n");
+        printf("[9]  Consultas entre inventarios (paralelas)\n");
         printf("[0]  Sair e abandonar missao\n");
         printf("\nEscolha: ");
         scanf("%d", &opcao);
@@ -609,7 +1349,8 @@ void menuPrincipal() {
                 cadastrarLote();
                 break;
             case 3:
-                mostrarComponentes(componentes, totalComponentes);
+                mostrarComponentes(inventarioAtual()->componentes, 
+                                   inventarioAtual()->totalComponentes);
                 break;
             case 4:
                 menuOrdenacao();
@@ -623,6 +1364,12 @@ void menuPrincipal() {
             case 7:
                 simularMontagem();
                 break;
+            case 8:
+                menuInventarios();
+                break;
+            case 9:
+                menuOperacoesParalelas();
+                break;
             case 0:
                 printf("\n========================================\n");
                 printf("  Missao encerrada.\n");
@@ -650,7 +1397,13 @@ int main() {
     printf("Organize os componentes estrategicamente para construir a torre\n");
     printf("de resgate e escapar da ilha antes que seja tarde demais.\n");
     
+    inicializarInventario(&inventarios[0], "Partida 1");
+    totalInventarios = 1;
+    iniciarPool();
+    
     menuPrincipal();
     
+    encerrarPool();
+    
     return 0;
 }
\ No newline at end of file